@@ -0,0 +1,95 @@
+#include "stm32f4_discovery.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <chrono>
+
+class DescriptorRing
+{
+	public:
+	static constexpr unsigned int capacity = 8;
+
+	DescriptorRing() = default;
+
+	void reserve(unsigned int n)
+	{
+		std::unique_lock lock(mutex_);
+		unsigned int ticket = next_++;
+		cv_.wait(lock, [&] { return ticket == serving_ && free_ >= n; });
+		free_ -= n;
+		serving_++;
+		cv_.notify_all();
+	}
+
+	void publish(unsigned int n)
+	{
+		ready_.release(n);
+	}
+
+	void consume()
+	{
+		ready_.acquire();
+		std::lock_guard lock(mutex_);
+		if (++free_ > capacity) abort();
+		cv_.notify_all();
+	}
+
+	bool idle() const
+	{
+		std::lock_guard lock(mutex_);
+		return free_ == capacity;
+	}
+
+	private:
+	mutable std::mutex mutex_;
+	std::condition_variable cv_;
+	std::counting_semaphore<capacity> ready_{0};
+	unsigned int free_ = capacity;
+	unsigned int next_ = 0;
+	unsigned int serving_ = 0;
+};
+
+void test()
+{
+	constexpr unsigned int threads = 4;
+	constexpr unsigned int loops = 100;
+	DescriptorRing ring;
+	unsigned int total = 0;
+	auto produce = [&ring](unsigned int n)
+	{
+		for (unsigned int i = 0; i < loops; i++)
+		{
+			ring.reserve(n);
+			std::this_thread::yield();
+			ring.publish(n);
+		}
+	};
+	std::vector<std::thread> workers;
+	for (unsigned int i = 0; i < threads; i++)
+	{
+		workers.emplace_back(produce, i + 2);
+		total += (i + 2) * loops;
+	}
+	std::thread consumer([&ring, total]
+	{
+		for (unsigned int i = 0; i < total; i++)
+			ring.consume();
+	});
+	for (auto& worker : workers)
+		worker.join();
+	consumer.join();
+	if (!ring.idle()) abort();
+}
+
+int main()
+{
+	using namespace std::chrono_literals;
+	device::Led led;
+	for (;;)
+	{
+		test();
+		std::this_thread::sleep_for(100ms);
+		led.tick();
+	}
+}
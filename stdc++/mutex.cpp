@@ -0,0 +1,58 @@
+#include "stm32f4_discovery.h"
+#include <thread>
+#include <mutex>
+#include <vector>
+#include <chrono>
+
+class ThreadSafeCounter
+{
+	public:
+	ThreadSafeCounter() = default;
+
+	unsigned int get() const
+	{
+		std::lock_guard lock(mutex_);
+		return value_;
+	}
+
+	void increment()
+	{
+		std::lock_guard lock(mutex_);
+		std::this_thread::yield();
+		value_++;
+	}
+
+	private:
+	mutable std::mutex mutex_;
+	unsigned int value_ = 0;
+};
+
+void test()
+{
+	constexpr unsigned int threads = 16;
+	constexpr unsigned int loops = 100;
+	ThreadSafeCounter counter;
+	auto increment = [&counter]()
+	{
+		for (unsigned int i = 0; i < loops; i++)
+			counter.increment();
+	};
+	std::vector<std::thread> workers;
+	for (unsigned int i = 0; i < threads; i++)
+		workers.emplace_back(increment);
+	for (auto& worker : workers)
+		worker.join();
+	if (counter.get() != threads * loops) abort();
+}
+
+int main()
+{
+	using namespace std::chrono_literals;
+	device::Led led;
+	for (;;)
+	{
+		test();
+		std::this_thread::sleep_for(100ms);
+		led.tick();
+	}
+}
@@ -8,12 +8,14 @@ include(${CMAKE_CURRENT_LIST_DIR}/test_event_queue/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_fast_mutex/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_flag/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_job_queue/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/test_latency/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_mailbox_queue/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_memory_pool/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_message_queue/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_mutex/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_once_flag/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_raw_buffer/config.cmake)
+include(${CMAKE_CURRENT_LIST_DIR}/test_rwlock/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_semaphore/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_signal/config.cmake)
 include(${CMAKE_CURRENT_LIST_DIR}/test_spin_lock/config.cmake)
@@ -30,6 +30,9 @@ extern "C" {
 void test_add (fun_t *fun);
 void test_call(fun_t *fun);
 
+void test_start(fun_t *fun, int cnt);
+void test_join (void);
+
 #ifdef  __cplusplus
 }
 #endif
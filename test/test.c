@@ -1,12 +1,19 @@
 #include "test.h"
 
 #define       LOOP 1
-#define       SIZE 68
+#define       SIZE 107
+#define       WORK 64
 
 static cnt_t  summary = 0;
 static fun_t *test[SIZE];
 static int    count = 0;
 
+static tsk_t  work[WORK];
+static OS_TSK_STACK(work_stk[WORK]);
+static evt_t  work_evt = EVT_INIT();
+static fun_t *work_fun;
+static int    work_cnt = 0;
+
 void test_add(fun_t *fun)
 {
 	ASSERT(count < SIZE);
@@ -25,6 +32,37 @@ void test_call(fun_t *fun)
 #endif
 }
 
+static void work_proc()
+{
+	unsigned event;
+	int result;
+	result = evt_wait(&work_evt, &event);
+	ASSERT_success(result);
+	work_fun();
+}
+
+void test_start(fun_t *fun, int cnt)
+{
+	int i;
+	ASSERT(cnt <= WORK);
+	work_fun = fun;
+	work_cnt = cnt;
+	for (i = 0; i < cnt; i++)
+		tsk_init(&work[i], 1, work_proc, work_stk[i], sizeof(work_stk[i]));
+	evt_give(&work_evt, 0);
+}
+
+void test_join()
+{
+	int i;
+	int result;
+	for (i = 0; i < work_cnt; i++)
+	{
+		result = tsk_join(&work[i]);
+		ASSERT_success(result);
+	}
+}
+
 static void test_init()
 {
 	TEST_Notify();
@@ -65,6 +103,7 @@ int main()
 	TEST_AddUnit(test_mutex);
 	TEST_AddUnit(test_fast_mutex);
 	TEST_AddUnit(test_condition_variable);
+	TEST_AddUnit(test_rwlock);
 	TEST_AddUnit(test_memory_pool);
 	TEST_AddUnit(test_raw_buffer);
 	TEST_AddUnit(test_message_queue);
@@ -73,6 +112,7 @@ int main()
 	TEST_AddUnit(test_job_queue);
 	TEST_AddUnit(test_timer);
 	TEST_AddUnit(test_task);
+	TEST_AddUnit(test_latency);
 
 	size_t h = sys_heapSize();
 	for (i = 0; i < count * LOOP * 2; i += 2)
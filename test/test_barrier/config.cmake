@@ -6,4 +6,5 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_barrier_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_barrier_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_barrier_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_barrier_parties.c
 )
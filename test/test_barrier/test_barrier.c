@@ -8,4 +8,7 @@ void test_barrier()
 	TEST_Add(test_barrier_2);
 	TEST_Add(test_barrier_3);
 #endif
+	TEST_Add(test_barrier_4);
+	TEST_Add(test_barrier_5);
+	TEST_Add(test_barrier_6);
 }
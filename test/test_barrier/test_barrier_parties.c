@@ -0,0 +1,47 @@
+#include "test.h"
+
+#define ROUNDS   4
+
+static_BAR(bar3, 1);
+
+static unsigned parties;
+
+static void proc()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		result = bar_wait(bar3);                  ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	         bar_init(bar3, parties);
+	         test_start(proc, parties);
+	         test_join();
+}
+
+void test_barrier_4()
+{
+	TEST_Notify();
+	parties = 4;
+	TEST_Call();
+}
+
+void test_barrier_5()
+{
+	TEST_Notify();
+	parties = 16;
+	TEST_Call();
+}
+
+void test_barrier_6()
+{
+	TEST_Notify();
+	parties = 64;
+	TEST_Call();
+}
@@ -6,4 +6,5 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_condition_variable_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_condition_variable_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_condition_variable_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_condition_variable_4.c
 )
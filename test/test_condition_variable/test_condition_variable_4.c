@@ -0,0 +1,44 @@
+#include "test.h"
+
+#define WAITERS 16
+
+static_MTX(mtx3, mtxDefault);
+static_CND(cnd3);
+
+static unsigned waiting;
+static unsigned inside;
+static unsigned counter;
+
+static void proc()
+{
+	int result;
+
+	result = mtx_wait(mtx3);                      ASSERT_success(result);
+	         waiting++;
+	result = cnd_wait(cnd3, mtx3);                ASSERT_success(result);
+	                                              ASSERT(inside == 0);
+	         inside++;
+	         tsk_yield();
+	         inside--;
+	         counter++;
+	result = mtx_give(mtx3);                      ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+
+	         waiting = inside = counter = 0;
+	         test_start(proc, WAITERS);           ASSERT(waiting == WAITERS);
+	result = mtx_wait(mtx3);                      ASSERT_success(result);
+	         cnd_give(cnd3, cndAll);
+	result = mtx_give(mtx3);                      ASSERT_success(result);
+	         test_join();                         ASSERT(counter == WAITERS);
+}
+
+void test_condition_variable_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -6,4 +6,6 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_event_queue_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_event_queue_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_event_queue_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_event_queue_4.c
+	${CMAKE_CURRENT_LIST_DIR}/test_event_queue_5.c
 )
@@ -8,4 +8,6 @@ void test_event_queue()
 	TEST_Add(test_event_queue_2);
 	TEST_Add(test_event_queue_3);
 #endif
+	TEST_Add(test_event_queue_4);
+	TEST_Add(test_event_queue_5);
 }
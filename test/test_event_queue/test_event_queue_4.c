@@ -0,0 +1,56 @@
+#include "test.h"
+
+#define COUNT 4
+
+static_EVQ(evq3, COUNT);
+
+static unsigned sent;
+static unsigned counter;
+
+static void proc2()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		result = evq_give(evq3, sent);            ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	unsigned received;
+	int result;
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		result = evq_wait(evq3, &received);       ASSERT_success(result);
+		                                          ASSERT(received == sent);
+		         counter++;
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+
+	         sent = (unsigned)rand();
+	         counter = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);          ASSERT_dead(tsk2);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	                                              ASSERT(counter == COUNT);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+}
+
+void test_event_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
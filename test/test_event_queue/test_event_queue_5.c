@@ -0,0 +1,37 @@
+#include "test.h"
+
+#define COUNT 4
+#define BURST (2 * COUNT)
+
+static_EVQ(evq3, COUNT);
+
+static void test()
+{
+	unsigned sent = (unsigned)rand();
+	unsigned received;
+	int result;
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		result = evq_give(evq3, sent);            ASSERT_success(result);
+		                                          ASSERT(evq_count(evq3) == i + 1);
+	}
+	for (; i < BURST; i++)
+	{
+		result = evq_give(evq3, sent);            ASSERT_timeout(result);
+		                                          ASSERT(evq_count(evq3) == COUNT);
+	}
+	for (i = 0; i < COUNT; i++)
+	{
+		result = evq_take(evq3, &received);       ASSERT_success(result);
+		                                          ASSERT(received == sent);
+	}
+	result = evq_take(evq3, &received);           ASSERT_timeout(result);
+}
+
+void test_event_queue_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
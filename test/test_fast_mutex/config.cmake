@@ -6,4 +6,5 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_fast_mutex_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_fast_mutex_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_fast_mutex_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_fast_mutex_4.c
 )
@@ -8,4 +8,5 @@ void test_fast_mutex()
 	TEST_Add(test_fast_mutex_2);
 	TEST_Add(test_fast_mutex_3);
 #endif
+	TEST_Add(test_fast_mutex_4);
 }
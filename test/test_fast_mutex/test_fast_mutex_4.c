@@ -0,0 +1,27 @@
+#include "test.h"
+
+#define ROUNDS 16
+
+static void test()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		result = mut_wait(&mut0);                 ASSERT_success(result);
+		result = mut_give(&mut0);                 ASSERT_success(result);
+		result = mut_take(&mut0);                 ASSERT_success(result);
+		result = mut_give(&mut0);                 ASSERT_success(result);
+		result = mut_wait(mut1);                  ASSERT_success(result);
+		result = mut_give(mut1);                  ASSERT_success(result);
+		result = mut_take(mut1);                  ASSERT_success(result);
+		result = mut_give(mut1);                  ASSERT_success(result);
+	}
+}
+
+void test_fast_mutex_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -8,4 +8,6 @@ void test_flag()
 	TEST_Add(test_flag_2);
 	TEST_Add(test_flag_3);
 #endif
+	TEST_Add(test_flag_4);
+	TEST_Add(test_flag_5);
 }
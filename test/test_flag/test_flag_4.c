@@ -0,0 +1,39 @@
+#include "test.h"
+
+#define WAITERS 32
+
+static_FLG(flg3, 0);
+
+static unsigned counter;
+static unsigned started;
+
+static void proc()
+{
+	unsigned flag = 1U << started++;
+	int result;
+
+	result = flg_wait(flg3, flag, flgAll);        ASSERT_success(result);
+	         counter++;
+	         tsk_stop();
+}
+
+static void test()
+{
+	unsigned flags;
+	unsigned i;
+
+	         counter = started = 0;
+	         test_start(proc, WAITERS);           ASSERT(started == WAITERS);
+	for (i = 0; i < WAITERS; i++)
+	{
+		         flags = flg_give(flg3, 1U << i); ASSERT(flags == 0);
+		                                          ASSERT(counter == i + 1);
+	}
+	         test_join();
+}
+
+void test_flag_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
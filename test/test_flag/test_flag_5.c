@@ -0,0 +1,71 @@
+#include "test.h"
+
+#define ROUNDS 12
+#define SIZE sizeof(unsigned)
+
+#define SEM_FLAG 1U
+#define MSG_FLAG 2U
+#define EVQ_FLAG 4U
+#define ALL_FLAG (SEM_FLAG | MSG_FLAG | EVQ_FLAG)
+
+static_FLG(flg3, 0);
+static_SEM(sem3, 0, semDefault);
+static_MSG(msg3, 1, SIZE);
+static_EVQ(evq3, 1);
+
+static unsigned received;
+
+static void proc1()
+{
+	int result;
+	unsigned value;
+	unsigned read = SIZE;
+
+	while (received < ROUNDS)
+	{
+		result = flg_wait(flg3, ALL_FLAG, flgAny); ASSERT_success(result);
+		if (sem_take(sem3) == E_SUCCESS)
+			received++;
+		if (msg_take(msg3, &value, SIZE, &read) == E_SUCCESS)
+			received++;
+		if (evq_take(evq3, &value) == E_SUCCESS)
+			received++;
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+	unsigned i;
+
+	         received = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	for (i = 1; i <= ROUNDS; i++)
+	{
+		switch (i % 3)
+		{
+		case 0:
+			result = sem_give(sem3);              ASSERT_success(result);
+			         flg_give(flg3, SEM_FLAG);
+			break;
+		case 1:
+			result = msg_give(msg3, &i, SIZE);    ASSERT_success(result);
+			         flg_give(flg3, MSG_FLAG);
+			break;
+		case 2:
+			result = evq_give(evq3, i);           ASSERT_success(result);
+			         flg_give(flg3, EVQ_FLAG);
+			break;
+		}
+		                                          ASSERT(received == i);
+	}
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+}
+
+void test_flag_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -8,4 +8,5 @@ void test_job_queue()
 	TEST_Add(test_job_queue_2);
 	TEST_Add(test_job_queue_3);
 #endif
+	TEST_Add(test_job_queue_4);
 }
@@ -0,0 +1,84 @@
+#include "test.h"
+
+#define COUNT 2
+
+static_JOB(job3, COUNT);
+static_JOB(job4, COUNT);
+static_TMR_DEF(tmr3) {}
+
+static unsigned upper;
+static unsigned lower;
+
+static void proc_upper()
+{
+	                                              ASSERT(lower == 0);
+	         upper++;
+}
+
+static void proc_lower()
+{
+	                                              ASSERT(upper == COUNT);
+	         lower++;
+}
+
+static void proc()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		result = job_giveISR(job4, proc_lower);   ASSERT_success(result);
+	}
+	for (i = 0; i < COUNT; i++)
+	{
+		result = job_giveISR(job3, proc_upper);   ASSERT_success(result);
+	}
+}
+
+static void proc2()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		result = job_wait(job3);                  ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < COUNT; i++)
+	{
+		result = job_wait(job4);                  ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+
+	         upper = lower = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2);
+	         tmr_startFrom(tmr3, 0, 0, proc);
+	result = tmr_wait(tmr3);                      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	                                              ASSERT(upper == COUNT);
+	                                              ASSERT(lower == COUNT);
+}
+
+void test_job_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,10 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/latency.c
+	${CMAKE_CURRENT_LIST_DIR}/test_latency.c
+	${CMAKE_CURRENT_LIST_DIR}/test_latency_1.c
+	${CMAKE_CURRENT_LIST_DIR}/test_latency_2.c
+	${CMAKE_CURRENT_LIST_DIR}/test_latency_3.c
+)
@@ -0,0 +1,117 @@
+#include "latency.h"
+
+#if LAT_TEST
+
+lat_t lat_entry    = { 0 };
+lat_t lat_unmasked = { 0 };
+lat_t lat_sem      = { 0 };
+lat_t lat_evt      = { 0 };
+
+static_SEM(sem9, 0, semBinary);
+static_EVT(evt9);
+
+static volatile unsigned stamp;
+static unsigned turn;
+
+static_TSK_DEF(tsk8, LAT_PRIO)
+{
+	int result;
+
+	for (;;)
+	{
+		result = sem_wait(sem9);                  ASSERT_success(result);
+		         lat_add(&lat_sem, DWT->CYCCNT - stamp);
+	}
+}
+
+static_TSK_DEF(tsk9, LAT_PRIO)
+{
+	unsigned value;
+	int result;
+
+	for (;;)
+	{
+		result = evt_wait(evt9, &value);          ASSERT_success(result);
+		         lat_add(&lat_evt, DWT->CYCCNT - value);
+	}
+}
+
+void TIM7_IRQHandler( void )
+{
+	unsigned cnt = TIM7->CNT;
+
+	TIM7->SR = ~TIM_SR_UIF;
+	lat_add(&lat_entry, cnt * (CPU_FREQUENCY / LAT_TIMER_FREQUENCY));
+
+	if (++turn & 1)
+	{
+		stamp = DWT->CYCCNT;
+		sem_giveISR(sem9);
+	}
+	else
+	{
+		evt_give(evt9, DWT->CYCCNT);
+	}
+}
+
+void TIM6_DAC_IRQHandler( void )
+{
+	unsigned cnt = TIM6->CNT;
+
+	TIM6->SR = ~TIM_SR_UIF;
+	lat_add(&lat_unmasked, cnt * (CPU_FREQUENCY / LAT_TIMER_FREQUENCY));
+}
+
+void lat_init()
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+	tsk_start(tsk8);
+	tsk_start(tsk9);
+
+	RCC->APB1ENR |= RCC_APB1ENR_TIM6EN | RCC_APB1ENR_TIM7EN;
+
+	/* kernel aware handler, the most urgent one masked in critical sections */
+	TIM7->PSC  = 0;
+	TIM7->ARR  = LAT_TIMER_FREQUENCY / 2003 - 1;
+	TIM7->EGR  = TIM_EGR_UG;
+	TIM7->SR   = 0;
+	TIM7->DIER = TIM_DIER_UIE;
+	NVIC_SetPriority(TIM7_IRQn, OS_LOCK_LEVEL);
+	NVIC_EnableIRQ(TIM7_IRQn);
+
+	/* handler more urgent than OS_LOCK_LEVEL, it never calls the kernel */
+	TIM6->PSC  = 0;
+	TIM6->ARR  = LAT_TIMER_FREQUENCY / 3001 - 1;
+	TIM6->EGR  = TIM_EGR_UG;
+	TIM6->SR   = 0;
+	TIM6->DIER = TIM_DIER_UIE;
+	NVIC_SetPriority(TIM6_DAC_IRQn, 0);
+	NVIC_EnableIRQ(TIM6_DAC_IRQn);
+
+	TIM7->CR1  = TIM_CR1_CEN;
+	TIM6->CR1  = TIM_CR1_CEN;
+}
+
+void lat_add( lat_t *lat, unsigned cycles )
+{
+	unsigned i = cycles / LAT_WIDTH;
+
+	lat->bin[i < LAT_BINS ? i : LAT_BINS - 1]++;
+	if (lat->max < cycles)
+		lat->max = cycles;
+	lat->count++;
+}
+
+void lat_print( const char *name, lat_t *lat )
+{
+	unsigned i;
+
+	printf("%s: %u samples, max %u cycles\n", name, lat->count, lat->max);
+	for (i = 0; i < LAT_BINS; i++)
+		if (lat->bin[i])
+			printf("%6u: %u\n", i * LAT_WIDTH, lat->bin[i]);
+}
+
+#endif//LAT_TEST
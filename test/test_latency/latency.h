@@ -0,0 +1,79 @@
+#include "test.h"
+
+#pragma once
+
+// ----------------------------
+// latency measurement
+// LAT_TEST == 0 => the unit is empty, no interrupt handlers, measuring tasks or histograms are built
+// LAT_TEST >  0 => TIM6 and TIM7 interrupts and two tasks of LAT_PRIO load every other unit
+// default value: 0
+#ifndef LAT_TEST
+#define LAT_TEST              0
+#endif
+
+// ----------------------------
+// histogram resolution: LAT_BINS bins, LAT_WIDTH cpu cycles each
+// the last bin also collects all samples out of range
+#define LAT_BINS             64
+#define LAT_WIDTH            32
+
+// ----------------------------
+// priority of the tasks woken from the interrupt handler
+// higher than the priority of any task used by the test units
+#define LAT_PRIO             10
+
+// ----------------------------
+// clock of the basic timers (TIM6, TIM7) in Hz
+// APB1 runs at CPU_FREQUENCY / LAT_APB1_DIV, its timers at twice that
+#define LAT_APB1_DIV          4
+#define LAT_TIMER_FREQUENCY (CPU_FREQUENCY * 2 / LAT_APB1_DIV)
+
+// ----------------------------
+// hardware delays of an interrupt entry in cpu cycles
+// exception entry with stacking of the FP context (Cortex-M4 TRM)
+// flash wait states at 168 MHz and 3.3 V (RM0090)
+#define LAT_EXC_ENTRY        29
+#define LAT_FLASH_WAIT        5
+
+// ----------------------------
+// acceptance limits in cpu cycles
+// the unmasked handler is delayed by the hardware only: the exception entry,
+// up to four flash line fetches missing the ART accelerator (vector and handler prologue),
+// two APB1 bus cycles reading TIMx->CNT and the resolution of the timer counter
+#ifndef LAT_ENTRY_LIMIT
+#define LAT_ENTRY_LIMIT    1024
+#endif
+#ifndef LAT_UNMASKED_LIMIT
+#if     OS_LOCK_LEVEL > 0
+#define LAT_UNMASKED_LIMIT (LAT_EXC_ENTRY + 4 * (LAT_FLASH_WAIT + 1) + 2 * LAT_APB1_DIV + CPU_FREQUENCY / LAT_TIMER_FREQUENCY)
+#else
+#define LAT_UNMASKED_LIMIT LAT_ENTRY_LIMIT
+#endif
+#endif
+#ifndef LAT_WAKEUP_LIMIT
+#define LAT_WAKEUP_LIMIT   2048
+#endif
+
+typedef struct
+{
+	volatile unsigned count; // number of samples
+	volatile unsigned max;   // worst case in cpu cycles
+	unsigned bin[LAT_BINS];  // histogram
+}	lat_t;
+
+extern lat_t lat_entry;    // entry to the handler masked by the kernel (TIM7)
+extern lat_t lat_unmasked; // entry to the handler not masked by the kernel (TIM6)
+extern lat_t lat_sem;      // from the handler to the task woken with sem_give
+extern lat_t lat_evt;      // from the handler to the task woken with evt_give
+
+#ifdef  __cplusplus
+extern "C" {
+#endif
+
+void lat_init (void);
+void lat_add  (lat_t *lat, unsigned cycles);
+void lat_print(const char *name, lat_t *lat);
+
+#ifdef  __cplusplus
+}
+#endif
@@ -0,0 +1,12 @@
+#include "latency.h"
+
+void test_latency()
+{
+	UNIT_Notify();
+#if LAT_TEST
+	lat_init();
+	TEST_Add(test_latency_1);
+	TEST_Add(test_latency_2);
+	TEST_Add(test_latency_3);
+#endif
+}
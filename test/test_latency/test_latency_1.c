@@ -0,0 +1,26 @@
+#include "latency.h"
+
+#if LAT_TEST
+
+static void test()
+{
+	unsigned count = lat_entry.count;
+	unsigned unmasked = lat_unmasked.count;
+
+	while (lat_entry.count == count || lat_unmasked.count == unmasked)
+		tsk_yield();
+	                                              ASSERT(lat_entry.max <= LAT_ENTRY_LIMIT);
+	                                              ASSERT(lat_unmasked.max <= LAT_UNMASKED_LIMIT);
+}
+
+void test_latency_1()
+{
+	TEST_Notify();
+	TEST_Call();
+#ifdef DEBUG
+	lat_print("entry", &lat_entry);
+	lat_print("unmasked", &lat_unmasked);
+#endif
+}
+
+#endif//LAT_TEST
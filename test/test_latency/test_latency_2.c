@@ -0,0 +1,23 @@
+#include "latency.h"
+
+#if LAT_TEST
+
+static void test()
+{
+	unsigned count = lat_sem.count;
+
+	while (lat_sem.count == count)
+		tsk_yield();
+	                                              ASSERT(lat_sem.max <= LAT_WAKEUP_LIMIT);
+}
+
+void test_latency_2()
+{
+	TEST_Notify();
+	TEST_Call();
+#ifdef DEBUG
+	lat_print("sem_give", &lat_sem);
+#endif
+}
+
+#endif//LAT_TEST
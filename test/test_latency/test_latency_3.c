@@ -0,0 +1,23 @@
+#include "latency.h"
+
+#if LAT_TEST
+
+static void test()
+{
+	unsigned count = lat_evt.count;
+
+	while (lat_evt.count == count)
+		tsk_yield();
+	                                              ASSERT(lat_evt.max <= LAT_WAKEUP_LIMIT);
+}
+
+void test_latency_3()
+{
+	TEST_Notify();
+	TEST_Call();
+#ifdef DEBUG
+	lat_print("evt_give", &lat_evt);
+#endif
+}
+
+#endif//LAT_TEST
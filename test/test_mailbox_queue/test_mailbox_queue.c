@@ -8,4 +8,8 @@ void test_mailbox_queue()
 	TEST_Add(test_mailbox_queue_2);
 	TEST_Add(test_mailbox_queue_3);
 #endif
+	TEST_Add(test_mailbox_queue_4);
+	TEST_Add(test_mailbox_queue_5);
+	TEST_Add(test_mailbox_queue_6);
+	TEST_Add(test_mailbox_queue_7);
 }
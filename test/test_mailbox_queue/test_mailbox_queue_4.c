@@ -0,0 +1,62 @@
+#include "test.h"
+
+#define COUNT     4
+#define THRESHOLD 3
+
+static_BOX(box3, COUNT, sizeof(unsigned));
+
+static unsigned counter;
+
+static void proc2()
+{
+	unsigned received;
+	unsigned i;
+	int result;
+
+	for (i = 1; i <= COUNT * 2; i++)
+	{
+		result = box_wait(box3, &received);       ASSERT_success(result);
+		                                          ASSERT(received == i);
+		         counter++;
+	}
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	unsigned sent;
+	int result;
+
+	for (sent = 1; sent <= COUNT; sent++)
+	{
+		result = box_give(box3, &sent);           ASSERT_success(result);
+		                                          ASSERT(counter == sent);
+	}
+	         tsk_prio(THRESHOLD);
+	for (; sent <= COUNT * 2; sent++)
+	{
+		result = box_give(box3, &sent);           ASSERT_success(result);
+		                                          ASSERT(counter == COUNT);
+	}
+	         tsk_prio(1);                         ASSERT(counter == COUNT * 2);
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+
+	         counter = 0;
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2);
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_dead(tsk1);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+}
+
+void test_mailbox_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,109 @@
+#include "test.h"
+
+#define ROUNDS 12
+#define SIZE sizeof(unsigned)
+
+static_BOX(box3, 1, SIZE);
+static_SEM(sem3, 0, semDefault);
+static_MSG(msg3, 1, SIZE);
+static_EVQ(evq3, 1);
+
+static unsigned received;
+
+static void proc4()
+{
+	int result;
+	unsigned i;
+	unsigned value;
+
+	for (i = 0; i < ROUNDS / 3; i++)
+	{
+		result = evq_wait(evq3, &value);          ASSERT_success(result);
+		result = box_give(box3, &value);          ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void proc3()
+{
+	int result;
+	unsigned i;
+	unsigned value;
+	unsigned read = SIZE;
+
+	for (i = 0; i < ROUNDS / 3; i++)
+	{
+		result = msg_wait(msg3, &value, SIZE, &read); ASSERT_success(result);
+		result = box_give(box3, &value);          ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void proc2()
+{
+	int result;
+	unsigned i;
+	unsigned value = 0;
+
+	for (i = 0; i < ROUNDS / 3; i++)
+	{
+		result = sem_wait(sem3);                  ASSERT_success(result);
+		result = box_give(box3, &value);          ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+	unsigned value;
+
+	while (received < ROUNDS)
+	{
+		result = box_wait(box3, &value);          ASSERT_success(result);
+		         received++;
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+	unsigned i;
+
+	         received = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);          ASSERT_ready(tsk2);
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);          ASSERT_ready(tsk3);
+	                                              ASSERT_dead(tsk4);
+	         tsk_startFrom(tsk4, proc4);          ASSERT_ready(tsk4);
+	for (i = 1; i <= ROUNDS; i++)
+	{
+		switch (i % 3)
+		{
+		case 0:
+			result = sem_give(sem3);              ASSERT_success(result);
+			break;
+		case 1:
+			result = msg_give(msg3, &i, SIZE);    ASSERT_success(result);
+			break;
+		case 2:
+			result = evq_give(evq3, i);           ASSERT_success(result);
+			break;
+		}
+		                                          ASSERT(received == i);
+	}
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	result = tsk_join(tsk4);                      ASSERT_success(result);
+}
+
+void test_mailbox_queue_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
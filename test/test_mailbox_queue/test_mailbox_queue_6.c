@@ -0,0 +1,52 @@
+#include "test.h"
+
+#define COUNT  4
+#define URGENT 0x80U
+
+static_BOX(box3, COUNT, sizeof(unsigned));
+static_BOX(box4, 1, sizeof(unsigned));
+static_SEM(sem3, 0, semDefault);
+
+static void proc1()
+{
+	unsigned received;
+	int result;
+	unsigned i;
+
+	result = sem_wait(sem3);                      ASSERT_success(result);
+	result = box_take(box4, &received);           ASSERT_success(result);
+	                                              ASSERT(received == URGENT);
+	for (i = 1; i <= COUNT; i++)
+	{
+		result = sem_wait(sem3);                  ASSERT_success(result);
+		result = box_take(box4, &received);       ASSERT_timeout(result);
+		result = box_take(box3, &received);       ASSERT_success(result);
+		                                          ASSERT(received == i);
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	unsigned sent;
+	int result;
+	unsigned i;
+
+	for (i = 1; i <= COUNT; i++)
+	{
+		result = box_give(box3, &i);              ASSERT_success(result);
+		result = sem_give(sem3);                  ASSERT_success(result);
+	}
+	         sent = URGENT;
+	result = box_give(box4, &sent);               ASSERT_success(result);
+	result = sem_give(sem3);                      ASSERT_success(result);
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+}
+
+void test_mailbox_queue_6()
+{
+	TEST_Notify();
+	TEST_Call();
+}
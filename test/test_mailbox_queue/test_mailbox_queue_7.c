@@ -0,0 +1,35 @@
+#include "test.h"
+
+#define COUNT   4
+#define SAMPLES (2 * COUNT)
+
+static_BOX(box3, COUNT, sizeof(unsigned));
+static_BOX(box4, 1, sizeof(unsigned));
+
+static void test()
+{
+	unsigned received;
+	int result;
+	unsigned i;
+
+	for (i = 1; i <= SAMPLES; i++)
+	{
+		         box_push(box3, &i);
+		         box_push(box4, &i);
+	}
+	for (i = SAMPLES - COUNT + 1; i <= SAMPLES; i++)
+	{
+		result = box_take(box3, &received);       ASSERT_success(result);
+		                                          ASSERT(received == i);
+	}
+	result = box_take(box3, &received);           ASSERT_timeout(result);
+	result = box_take(box4, &received);           ASSERT_success(result);
+	                                              ASSERT(received == SAMPLES);
+	result = box_take(box4, &received);           ASSERT_timeout(result);
+}
+
+void test_mailbox_queue_7()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -6,4 +6,7 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_memory_pool_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_memory_pool_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_memory_pool_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_memory_pool_4.c
+	${CMAKE_CURRENT_LIST_DIR}/test_memory_pool_5.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_memory_pool_6.c
 )
@@ -8,4 +8,9 @@ void test_memory_pool()
 	TEST_Add(test_memory_pool_2);
 	TEST_Add(test_memory_pool_3);
 #endif
+	TEST_Add(test_memory_pool_4);
+#ifndef __CSMC__
+	TEST_Add(test_memory_pool_5);
+#endif
+	TEST_Add(test_memory_pool_6);
 }
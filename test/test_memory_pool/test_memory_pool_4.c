@@ -0,0 +1,42 @@
+#include "test.h"
+
+#define BLOCKS 4
+
+static_MEM(mem3, BLOCKS, sizeof(unsigned));
+static_TMR_DEF(tmr3) {}
+
+static void proc()
+{
+	void * p[BLOCKS];
+	void * q;
+	int result;
+	unsigned i;
+
+	for (i = 0; i < BLOCKS; i++)
+	{
+		result = mem_take(mem3, &p[i]);           ASSERT_success(result);
+		         *(unsigned *)p[i] = i;
+	}
+	result = mem_take(mem3, &q);                  ASSERT_timeout(result);
+	for (i = 0; i < BLOCKS; i++)
+	{
+		                                          ASSERT(*(unsigned *)p[i] == i);
+		         mem_give(mem3, p[i]);
+	}
+}
+
+static void test()
+{
+	int result;
+
+	         proc();
+	         tmr_startFrom(tmr3, 0, 0, proc);
+	result = tmr_wait(tmr3);                      ASSERT_success(result);
+	         proc();
+}
+
+void test_memory_pool_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
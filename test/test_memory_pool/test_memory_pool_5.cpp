@@ -0,0 +1,70 @@
+#include "test.h"
+
+#define BLOCKS 2
+#define COUNT  8
+
+using namespace stateos;
+
+auto Lst4 = ListTT<unsigned>();
+auto Mem4 = MemoryPoolTT<BLOCKS, unsigned>();
+
+static auto Evt4 = Event();
+
+static unsigned sum;
+
+static void producer()
+{
+	unsigned event;
+	unsigned *p;
+	int result;
+	unsigned i;
+
+	result = Evt4.wait(&event);                   ASSERT_success(result);
+	for (i = 1; i <= COUNT; i++)
+	{
+		result = Mem4.wait(&p);                   ASSERT_success(result);
+		         *p = i;
+		         Lst4.give(p);
+	}
+	         thisTask::stop();
+}
+
+static void consumer()
+{
+	unsigned *p;
+	int result;
+	unsigned i;
+
+	for (i = 0; i < 2 * COUNT; i++)
+	{
+		result = Lst4.wait(&p);                   ASSERT_success(result);
+		         sum += *p;
+		         Mem4.give(p);
+	}
+	         thisTask::stop();
+}
+
+static void test()
+{
+	int result;
+
+	         sum = 0;
+	                                              ASSERT(!Tsk1);
+	         Tsk1.startFrom(consumer);            ASSERT(!!Tsk1);
+	                                              ASSERT(!Tsk2);
+	         Tsk2.startFrom(producer);            ASSERT(!!Tsk2);
+	                                              ASSERT(!Tsk3);
+	         Tsk3.startFrom(producer);            ASSERT(!!Tsk3);
+	         Evt4.give(0);
+	result = Tsk3.join();                         ASSERT_success(result);
+	result = Tsk2.join();                         ASSERT_success(result);
+	result = Tsk1.join();                         ASSERT_success(result);
+	                                              ASSERT(sum == COUNT * (COUNT + 1));
+}
+
+extern "C"
+void test_memory_pool_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
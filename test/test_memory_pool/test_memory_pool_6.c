@@ -0,0 +1,67 @@
+#include "test.h"
+
+#define ITEMS 4
+
+static_LST(lst3);
+static_MEM(mem3, 3 * ITEMS, sizeof(unsigned));
+static_TMR_DEF(tmr3) {}
+
+static unsigned sum;
+
+static void produce()
+{
+	void * p;
+	int result;
+	unsigned i;
+
+	for (i = 1; i <= ITEMS; i++)
+	{
+		result = mem_take(mem3, &p);              ASSERT_success(result);
+		         *(unsigned *)p = i;
+		         lst_give(lst3, p);
+	}
+}
+
+static void proc2()
+{
+	         produce();
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	void * p;
+	int result;
+	unsigned i;
+
+	for (i = 0; i < 3 * ITEMS; i++)
+	{
+		result = lst_wait(lst3, &p);              ASSERT_success(result);
+		         sum += *(unsigned *)p;
+		         mem_give(mem3, p);
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+
+	         sum = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	         tmr_startFrom(tmr3, 0, 0, produce);
+	result = tmr_wait(tmr3);                      ASSERT_success(result);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);
+	         produce();
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	                                              ASSERT(sum == 3 * ITEMS * (ITEMS + 1) / 2);
+}
+
+void test_memory_pool_6()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -6,4 +6,7 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_message_queue_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_message_queue_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_message_queue_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_message_queue_4.c
+	${CMAKE_CURRENT_LIST_DIR}/test_message_queue_5.c
+	${CMAKE_CURRENT_LIST_DIR}/test_message_queue_6.c
 )
@@ -8,4 +8,7 @@ void test_message_queue()
 	TEST_Add(test_message_queue_2);
 	TEST_Add(test_message_queue_3);
 #endif
+	TEST_Add(test_message_queue_4);
+	TEST_Add(test_message_queue_5);
+	TEST_Add(test_message_queue_6);
 }
@@ -0,0 +1,55 @@
+#include "test.h"
+
+#define ROUNDS 16
+#define SIZE sizeof(unsigned)
+
+static_MSG(msg3, 1, SIZE);
+static_MSG(msg4, 1, SIZE);
+
+static unsigned counter;
+
+static void proc1()
+{
+	int result;
+	unsigned i;
+	unsigned value;
+	unsigned read = SIZE;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		result = msg_wait(msg3, &value, SIZE, &read); ASSERT_success(result);
+		                                          ASSERT(read == SIZE);
+		         counter++;
+		result = msg_give(msg4, &value, SIZE);    ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+	unsigned i;
+	unsigned sent;
+	unsigned value;
+	unsigned read = SIZE;
+
+	         counter = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	for (i = 1; i <= ROUNDS; i++)
+	{
+		         sent = (unsigned)rand();
+		result = msg_give(msg3, &sent, SIZE);     ASSERT_success(result);
+		                                          ASSERT(counter == i);
+		result = msg_wait(msg4, &value, SIZE, &read); ASSERT_success(result);
+		                                          ASSERT(read == SIZE);
+		                                          ASSERT(value == sent);
+	}
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+}
+
+void test_message_queue_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,54 @@
+#include "test.h"
+
+#define COUNT  4
+#define URGENT 0x80U
+#define SIZE sizeof(unsigned)
+
+static_MSG(msg3, COUNT, SIZE);
+static_MSG(msg4, 1, SIZE);
+static_SEM(sem3, 0, semDefault);
+
+static void proc1()
+{
+	unsigned received;
+	unsigned read = SIZE;
+	int result;
+	unsigned i;
+
+	result = sem_wait(sem3);                      ASSERT_success(result);
+	result = msg_take(msg4, &received, SIZE, &read); ASSERT_success(result);
+	                                              ASSERT(received == URGENT);
+	for (i = 1; i <= COUNT; i++)
+	{
+		result = sem_wait(sem3);                  ASSERT_success(result);
+		result = msg_take(msg4, &received, SIZE, &read); ASSERT_timeout(result);
+		result = msg_take(msg3, &received, SIZE, &read); ASSERT_success(result);
+		                                          ASSERT(received == i);
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	unsigned sent;
+	int result;
+	unsigned i;
+
+	for (i = 1; i <= COUNT; i++)
+	{
+		result = msg_give(msg3, &i, SIZE);        ASSERT_success(result);
+		result = sem_give(sem3);                  ASSERT_success(result);
+	}
+	         sent = URGENT;
+	result = msg_give(msg4, &sent, SIZE);         ASSERT_success(result);
+	result = sem_give(sem3);                      ASSERT_success(result);
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+}
+
+void test_message_queue_5()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,53 @@
+#include "test.h"
+
+#define MIN   2
+#define MAX  16
+#define COUNT (MAX - MIN + 1)
+#define LIMIT (COUNT * (MAX + 1) / MIN)
+
+static_MSG(msg3, COUNT, MAX);
+
+static unsigned capacity;
+
+static unsigned length(unsigned n)
+{
+	return MIN + n % COUNT;
+}
+
+static void test()
+{
+	unsigned char record[MAX];
+	unsigned read;
+	unsigned count;
+	int result;
+	unsigned i;
+	unsigned j;
+
+	for (count = 0; count < LIMIT; count++)
+	{
+		for (j = 0; j < length(count); j++)
+			record[j] = (unsigned char)(count + j);
+		result = msg_give(msg3, record, length(count));
+		if (result != E_SUCCESS)
+			break;
+	}
+	                                              ASSERT_timeout(result);
+	         capacity = count;                    ASSERT(count >= COUNT);
+	for (i = 0; i < count; i++)
+	{
+		result = msg_take(msg3, record, MAX, &read); ASSERT_success(result);
+		                                          ASSERT(read == length(i));
+		for (j = 0; j < read; j++)
+			                                      ASSERT(record[j] == (unsigned char)(i + j));
+	}
+	result = msg_take(msg3, record, MAX, &read);  ASSERT_timeout(result);
+}
+
+void test_message_queue_6()
+{
+	TEST_Notify();
+	TEST_Call();
+#ifdef DEBUG
+	printf("msg_t: %u records\n", capacity);
+#endif
+}
@@ -8,4 +8,8 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_mutex_3.c
 	${CMAKE_CURRENT_LIST_DIR}/test_mutex_4.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_mutex_5.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_mutex_6.c
+	${CMAKE_CURRENT_LIST_DIR}/test_mutex_7.c
+	${CMAKE_CURRENT_LIST_DIR}/test_mutex_8.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_mutex_9.c
 )
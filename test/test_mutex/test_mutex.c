@@ -10,4 +10,10 @@ void test_mutex()
 	TEST_Add(test_mutex_4);
 	TEST_Add(test_mutex_5);
 #endif
+	TEST_Add(test_mutex_6);
+	TEST_Add(test_mutex_7);
+#ifndef __CSMC__
+	TEST_Add(test_mutex_8);
+#endif
+	TEST_Add(test_mutex_9);
 }
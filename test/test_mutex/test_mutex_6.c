@@ -0,0 +1,34 @@
+#include "test.h"
+
+#define ROUNDS 16
+
+static void test()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		result = mtx_wait(&mtx0);                 ASSERT_success(result);
+		result = mtx_give(&mtx0);                 ASSERT_success(result);
+		result = mtx_take(&mtx0);                 ASSERT_success(result);
+		result = mtx_give(&mtx0);                 ASSERT_success(result);
+		result = mtx_wait(mtx1);                  ASSERT_success(result);
+		result = mtx_give(mtx1);                  ASSERT_success(result);
+		result = mtx_take(mtx1);                  ASSERT_success(result);
+		result = mtx_give(mtx1);                  ASSERT_success(result);
+		result = mtx_wait(mtx2);                  ASSERT_success(result);
+		result = mtx_take(mtx2);                  ASSERT_success(result);
+		result = mtx_give(mtx2);                  ASSERT_success(result);
+		result = mtx_give(mtx2);                  ASSERT_success(result);
+	}
+}
+
+void test_mutex_6()
+{
+	TEST_Notify();
+	mtx_init(&mtx0, mtxNormal, 0);
+	mtx_init(mtx1, mtxErrorCheck, 0);
+	mtx_init(mtx2, mtxRecursive, 0);
+	TEST_Call();
+}
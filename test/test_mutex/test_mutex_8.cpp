@@ -0,0 +1,63 @@
+#include "test.h"
+
+using namespace stateos;
+
+static auto Mtx3 = Mutex(mtxPrioInherit);
+static auto Mtx4 = Mutex(mtxPrioProtect, 3);
+
+static Mutex *Mtx;
+static unsigned started;
+static unsigned counter;
+
+static void proc2()
+{
+	int result;
+
+	         started++;
+	result = Mtx->wait();                         ASSERT_success(result);
+	         counter++;
+	result = Mtx->give();                         ASSERT_success(result);
+	         thisTask::stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	         Mtx = &Mtx3;
+	         started = counter = 0;
+	result = Mtx->wait();                         ASSERT_success(result);
+	                                              ASSERT(!Tsk2);
+	         Tsk2.startFrom(proc2);               ASSERT(started == 1);
+	                                              ASSERT(counter == 0);
+	result = Mtx->give();                         ASSERT_success(result);
+	                                              ASSERT(counter == 1);
+	result = Tsk2.join();                         ASSERT_success(result);
+
+	         Mtx = &Mtx4;
+	         started = counter = 0;
+	result = Mtx->wait();                         ASSERT_success(result);
+	                                              ASSERT(!Tsk2);
+	         Tsk2.startFrom(proc2);               ASSERT(started == 0);
+	                                              ASSERT(counter == 0);
+	result = Mtx->give();                         ASSERT_success(result);
+	                                              ASSERT(started == 1);
+	                                              ASSERT(counter == 1);
+	result = Tsk2.join();                         ASSERT_success(result);
+	         thisTask::stop();
+}
+
+static void test()
+{
+	int result;
+	                                              ASSERT(!Tsk1);
+	         Tsk1.startFrom(proc1);
+	result = Tsk1.join();                         ASSERT_success(result);
+}
+
+extern "C"
+void test_mutex_8()
+{
+	TEST_Notify();
+	TEST_Call();
+}
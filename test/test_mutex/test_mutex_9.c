@@ -0,0 +1,47 @@
+#include "test.h"
+
+static_MTX(mtx3, mtxPrioProtect, 3);
+
+static unsigned started;
+static unsigned counter;
+
+static void proc2()
+{
+	int result;
+
+	         started++;
+	result = mtx_wait(mtx3);                      ASSERT_success(result);
+	         counter++;
+	result = mtx_give(mtx3);                      ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	         started = counter = 0;
+	result = mtx_wait(mtx3);                      ASSERT_success(result);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);          ASSERT(started == 0);
+	                                              ASSERT(counter == 0);
+	result = mtx_give(mtx3);                      ASSERT_success(result);
+	                                              ASSERT(started == 1);
+	                                              ASSERT(counter == 1);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+}
+
+void test_mutex_9()
+{
+	TEST_Notify();
+	TEST_Call();
+}
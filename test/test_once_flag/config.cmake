@@ -6,4 +6,5 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_once_flag_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_once_flag_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_once_flag_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_once_flag_4.c
 )
@@ -8,4 +8,5 @@ void test_once_flag()
 	TEST_Add(test_once_flag_2);
 	TEST_Add(test_once_flag_3);
 #endif
+	TEST_Add(test_once_flag_4);
 }
@@ -0,0 +1,33 @@
+#include "test.h"
+
+#define CALLS 64
+
+static_ONE(one4);
+
+static int counter = 0;
+
+static void proc()
+{
+	sys_lock();
+	{
+		counter++;
+	}
+	sys_unlock();
+}
+
+static void test()
+{
+	unsigned i;
+
+	for (i = 0; i < CALLS; i++)
+	{
+		         one_call(one4, proc);
+	}
+	                                              ASSERT(counter == 1);
+}
+
+void test_once_flag_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -6,4 +6,6 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_raw_buffer_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_raw_buffer_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_raw_buffer_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_raw_buffer_4.c
+	${CMAKE_CURRENT_LIST_DIR}/test_raw_buffer_5.c
 )
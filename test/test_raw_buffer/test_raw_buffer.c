@@ -8,4 +8,6 @@ void test_raw_buffer()
 	TEST_Add(test_raw_buffer_2);
 	TEST_Add(test_raw_buffer_3);
 #endif
+	TEST_Add(test_raw_buffer_4);
+	TEST_Add(test_raw_buffer_5);
 }
@@ -0,0 +1,71 @@
+#include "test.h"
+#include <string.h>
+
+#define HEAD  2
+#define BODY  4
+#define TAIL  2
+#define FRAME (HEAD + BODY + TAIL)
+
+static_RAW(raw3, 2 * FRAME);
+
+static const unsigned char head[HEAD] = { 0x7E, 0x04 };
+static const unsigned char body[BODY] = { 0x10, 0x20, 0x30, 0x40 };
+static const unsigned char tail[TAIL] = { 0x5A, 0xA5 };
+
+static void send()
+{
+	int result;
+
+	result = raw_give(raw3, head, HEAD);          ASSERT_success(result);
+	result = raw_give(raw3, body, BODY);          ASSERT_success(result);
+	result = raw_give(raw3, tail, TAIL);          ASSERT_success(result);
+}
+
+static void proc2()
+{
+	         send();
+	         tsk_stop();
+}
+
+static void test()
+{
+	unsigned char frame[2 * FRAME];
+	unsigned read;
+	int result;
+
+	         send();
+	result = raw_wait(raw3, frame, FRAME, &read); ASSERT_success(result);
+	                                              ASSERT(read == FRAME);
+	                                              ASSERT(memcmp(frame, head, HEAD) == 0);
+	                                              ASSERT(memcmp(frame + HEAD, body, BODY) == 0);
+	                                              ASSERT(memcmp(frame + HEAD + BODY, tail, TAIL) == 0);
+	         send();
+	result = raw_wait(raw3, frame, HEAD, &read);  ASSERT_success(result);
+	                                              ASSERT(read == HEAD);
+	                                              ASSERT(memcmp(frame, head, HEAD) == 0);
+	result = raw_wait(raw3, frame, BODY, &read);  ASSERT_success(result);
+	                                              ASSERT(read == BODY);
+	                                              ASSERT(memcmp(frame, body, BODY) == 0);
+	result = raw_wait(raw3, frame, TAIL, &read);  ASSERT_success(result);
+	                                              ASSERT(read == TAIL);
+	                                              ASSERT(memcmp(frame, tail, TAIL) == 0);
+	result = raw_give(raw3, head, HEAD);          ASSERT_success(result);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);          ASSERT_dead(tsk2);
+	result = raw_give(raw3, body, BODY);          ASSERT_success(result);
+	result = raw_give(raw3, tail, TAIL);          ASSERT_success(result);
+	result = raw_wait(raw3, frame, 2 * FRAME, &read); ASSERT_success(result);
+	                                              ASSERT(read == 2 * FRAME);
+	                                              ASSERT(memcmp(frame, head, HEAD) == 0);
+	                                              ASSERT(memcmp(frame + HEAD, head, HEAD) == 0);
+	                                              ASSERT(memcmp(frame + HEAD + HEAD, body, BODY) == 0);
+	                                              ASSERT(memcmp(frame + HEAD + HEAD + BODY, tail, TAIL) == 0);
+	                                              ASSERT(memcmp(frame + FRAME + HEAD, body, BODY) == 0);
+	                                              ASSERT(memcmp(frame + FRAME + HEAD + BODY, tail, TAIL) == 0);
+}
+
+void test_raw_buffer_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -0,0 +1,47 @@
+#include "test.h"
+
+#define MIN   2
+#define MAX  16
+#define COUNT (MAX - MIN + 1)
+#define TOTAL (COUNT + (MIN + MAX) * COUNT / 2)
+
+static_RAW(raw3, TOTAL);
+
+static void test()
+{
+	unsigned char record[MAX + 1];
+	unsigned char stream[TOTAL];
+	unsigned read;
+	unsigned pos;
+	int result;
+	unsigned i;
+	unsigned j;
+
+	for (i = MIN; i <= MAX; i++)
+	{
+		record[0] = (unsigned char)i;
+		for (j = 0; j < i; j++)
+			record[j + 1] = (unsigned char)(i + j);
+		result = raw_give(raw3, record, i + 1);   ASSERT_success(result);
+	}
+	result = raw_give(raw3, record, 1);           ASSERT_timeout(result);
+	result = raw_wait(raw3, stream, TOTAL, &read); ASSERT_success(result);
+	                                              ASSERT(read == TOTAL);
+	for (i = MIN, pos = 0; i <= MAX; i++)
+	{
+		                                          ASSERT(stream[pos] == i);
+		for (j = 0; j < i; j++)
+			                                      ASSERT(stream[pos + 1 + j] == (unsigned char)(i + j));
+		         pos += i + 1;
+	}
+	                                              ASSERT(pos == TOTAL);
+}
+
+void test_raw_buffer_5()
+{
+	TEST_Notify();
+	TEST_Call();
+#ifdef DEBUG
+	printf("raw_t: %u records in %u bytes\n", COUNT, TOTAL);
+#endif
+}
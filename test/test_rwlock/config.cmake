@@ -0,0 +1,7 @@
+include_guard(GLOBAL)
+
+target_sources(test
+	PRIVATE
+	${CMAKE_CURRENT_LIST_DIR}/test_rwlock.c
+	${CMAKE_CURRENT_LIST_DIR}/test_rwlock_readers.c
+)
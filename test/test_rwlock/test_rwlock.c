@@ -0,0 +1,9 @@
+#include "test.h"
+
+void test_rwlock()
+{
+	UNIT_Notify();
+	TEST_Add(test_rwlock_1);
+	TEST_Add(test_rwlock_2);
+	TEST_Add(test_rwlock_3);
+}
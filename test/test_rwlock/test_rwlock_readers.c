@@ -0,0 +1,70 @@
+#include "test.h"
+
+#define ROUNDS   4
+
+static_RWL(rwl3);
+
+static unsigned readers;
+static unsigned started;
+static unsigned value;
+
+static void reader()
+{
+	unsigned check;
+	unsigned i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		         rwl_lockRead(rwl3);
+		         check = value;
+		         tsk_yield();                     ASSERT(check == value);
+		         rwl_unlockRead(rwl3);
+	}
+	         tsk_stop();
+}
+
+static void writer()
+{
+	         rwl_lockWrite(rwl3);
+	         value++;
+	         tsk_yield();
+	         rwl_unlockWrite(rwl3);
+	         tsk_stop();
+}
+
+static void proc()
+{
+	if (started++ < readers)
+		reader();
+	else
+		writer();
+}
+
+static void test()
+{
+	         value = started = 0;
+	         test_start(proc, readers + 1);
+	         test_join();                         ASSERT(started == readers + 1);
+	                                              ASSERT(value == 1);
+}
+
+void test_rwlock_1()
+{
+	TEST_Notify();
+	readers = 1;
+	TEST_Call();
+}
+
+void test_rwlock_2()
+{
+	TEST_Notify();
+	readers = 4;
+	TEST_Call();
+}
+
+void test_rwlock_3()
+{
+	TEST_Notify();
+	readers = 16;
+	TEST_Call();
+}
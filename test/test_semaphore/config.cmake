@@ -6,4 +6,5 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_semaphore_1.c
 	${CMAKE_CURRENT_LIST_DIR}/test_semaphore_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_semaphore_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_semaphore_4.c
 )
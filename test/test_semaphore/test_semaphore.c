@@ -8,4 +8,5 @@ void test_semaphore()
 	TEST_Add(test_semaphore_2);
 	TEST_Add(test_semaphore_3);
 #endif
+	TEST_Add(test_semaphore_4);
 }
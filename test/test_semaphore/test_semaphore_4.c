@@ -0,0 +1,45 @@
+#include "test.h"
+
+#define ROUNDS 16
+
+static_SEM(sem3, 0, semBinary);
+static_SEM(sem4, 0, semBinary);
+
+static unsigned counter;
+
+static void proc1()
+{
+	int result;
+	unsigned i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		result = sem_wait(sem3);                  ASSERT_success(result);
+		         counter++;
+		result = sem_give(sem4);                  ASSERT_success(result);
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+	unsigned i;
+
+	         counter = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	for (i = 1; i <= ROUNDS; i++)
+	{
+		result = sem_give(sem3);                  ASSERT_success(result);
+		                                          ASSERT(counter == i);
+		result = sem_wait(sem4);                  ASSERT_success(result);
+	}
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+}
+
+void test_semaphore_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
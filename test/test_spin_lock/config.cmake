@@ -3,4 +3,8 @@ include_guard(GLOBAL)
 target_sources(test
 	PRIVATE
 	${CMAKE_CURRENT_LIST_DIR}/test_spin_lock.c
+	${CMAKE_CURRENT_LIST_DIR}/test_spin_lock_1.c
+	${CMAKE_CURRENT_LIST_DIR}/test_spin_lock_2.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_spin_lock_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_spin_lock_4.c
 )
@@ -0,0 +1,69 @@
+#include "test.h"
+
+static_SPN(spn3);
+
+static unsigned counter;
+
+static void proc3()
+{
+	         spn_lock(spn3);
+	         counter++;
+	         spn_unlock(spn3);
+	         tsk_stop();
+}
+
+static void proc2()
+{
+	int result;
+
+	         spn_lock(spn2);
+	         counter++;
+	         spn_unlock(spn2);
+	                                              ASSERT_dead(tsk3);
+	         tsk_startFrom(tsk3, proc3);          ASSERT_dead(tsk3);
+	result = tsk_join(tsk3);                      ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	         spn_lock(spn1);
+	         counter++;
+	         spn_unlock(spn1);
+	                                              ASSERT_dead(tsk2);
+	         tsk_startFrom(tsk2, proc2);          ASSERT_dead(tsk2);
+	result = tsk_join(tsk2);                      ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void proc0()
+{
+	int result;
+
+	         spn_lock(&spn0);
+	         counter++;
+	         spn_unlock(&spn0);
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_dead(tsk1);
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+
+	         counter = 0;
+	                                              ASSERT_dead(&tsk0);
+	         tsk_startFrom(&tsk0, proc0);
+	result = tsk_join(&tsk0);                     ASSERT_success(result);
+	                                              ASSERT(counter == 4);
+}
+
+void test_spin_lock_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}
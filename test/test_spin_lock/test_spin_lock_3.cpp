@@ -0,0 +1,75 @@
+#include "test.h"
+
+using namespace stateos;
+
+auto Spn0 = SpinLock();
+auto Spn1 = SpinLock();
+auto Spn2 = SpinLock();
+auto Spn3 = SpinLock();
+
+static unsigned counter;
+
+static void proc3()
+{
+	         Spn3.lock();
+	         counter++;
+	         Spn3.unlock();
+	         thisTask::stop();
+}
+
+static void proc2()
+{
+	int result;
+
+	         Spn2.lock();
+	         counter++;
+	         Spn2.unlock();
+	                                              ASSERT(!Tsk3);
+	         Tsk3.startFrom(proc3);               ASSERT(!Tsk3);
+	result = Tsk3.join();                         ASSERT_success(result);
+	         thisTask::stop();
+}
+
+static void proc1()
+{
+	int result;
+
+	         Spn1.lock();
+	         counter++;
+	         Spn1.unlock();
+	                                              ASSERT(!Tsk2);
+	         Tsk2.startFrom(proc2);               ASSERT(!Tsk2);
+	result = Tsk2.join();                         ASSERT_success(result);
+	         thisTask::stop();
+}
+
+static void proc0()
+{
+	int result;
+
+	         Spn0.lock();
+	         counter++;
+	         Spn0.unlock();
+	                                              ASSERT(!Tsk1);
+	         Tsk1.startFrom(proc1);               ASSERT(!Tsk1);
+	result = Tsk1.join();                         ASSERT_success(result);
+	         thisTask::stop();
+}
+
+static void test()
+{
+	int result;
+
+	         counter = 0;
+	                                              ASSERT(!Tsk0);
+	         Tsk0.startFrom(proc0);
+	result = Tsk0.join();                         ASSERT_success(result);
+	                                              ASSERT(counter == 4);
+}
+
+extern "C"
+void test_spin_lock_3()
+{
+	TEST_Notify();
+	TEST_Call();
+}
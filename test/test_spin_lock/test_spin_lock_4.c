@@ -0,0 +1,35 @@
+#include "test.h"
+
+#define WORKERS  4
+#define ROUNDS   16
+
+static_SPN(spn3);
+
+static unsigned counter;
+
+static void proc()
+{
+	unsigned i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		         spn_lock(spn3);
+		         counter++;
+		         spn_unlock(spn3);
+		         tsk_yield();
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	         counter = 0;
+	         test_start(proc, WORKERS);
+	         test_join();                         ASSERT(counter == WORKERS * ROUNDS);
+}
+
+void test_spin_lock_4()
+{
+	TEST_Notify();
+	TEST_Call();
+}
@@ -16,4 +16,5 @@ target_sources(test
 	${CMAKE_CURRENT_LIST_DIR}/test_task_infinite_loop_3.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_task_signal_2.cpp
 	${CMAKE_CURRENT_LIST_DIR}/test_task_signal_3.cpp
+	${CMAKE_CURRENT_LIST_DIR}/test_task_suspend_1.c
 )
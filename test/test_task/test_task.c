@@ -18,4 +18,5 @@ void test_task()
 	TEST_Add(test_task_create_5);
 	TEST_Add(test_task_create_6);
 #endif
+	TEST_Add(test_task_suspend_1);
 }
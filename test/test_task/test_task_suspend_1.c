@@ -0,0 +1,39 @@
+#include "test.h"
+
+#define ROUNDS 16
+
+static unsigned counter;
+
+static void proc1()
+{
+	unsigned i;
+
+	for (i = 0; i < ROUNDS; i++)
+	{
+		         tsk_suspend(SELF);
+		         counter++;
+	}
+	         tsk_stop();
+}
+
+static void test()
+{
+	int result;
+	unsigned i;
+
+	         counter = 0;
+	                                              ASSERT_dead(tsk1);
+	         tsk_startFrom(tsk1, proc1);          ASSERT_ready(tsk1);
+	for (i = 1; i <= ROUNDS; i++)
+	{
+		result = tsk_resume(tsk1);                ASSERT_success(result);
+		                                          ASSERT(counter == i);
+	}
+	result = tsk_join(tsk1);                      ASSERT_success(result);
+}
+
+void test_task_suspend_1()
+{
+	TEST_Notify();
+	TEST_Call();
+}